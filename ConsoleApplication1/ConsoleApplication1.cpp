@@ -14,6 +14,15 @@
 #include <regex>
 #include <map>
 #include <memory>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
 namespace Config {
     constexpr int WINDOW_WIDTH = 1000;
     constexpr int WINDOW_HEIGHT = 700;
@@ -98,9 +107,8 @@ public:
     int number;
     std::string type;
     double price;
-    bool available;
     
-    Room(int n, std::string t, double p) : number(n), type(t), price(p), available(true) {}
+    Room(int n, std::string t, double p) : number(n), type(t), price(p) {}
     virtual ~Room() = default;
     virtual std::string getAmenities() const { return "Basic"; }
 };
@@ -128,9 +136,10 @@ public:
     int id, guestId, roomNumber, nights;
     std::string checkIn, checkOut, mealPref;
     double totalAmount;
+    int checkInKey, checkOutKey; // HotelSystem::dateKey of checkIn / checkOut
 
-    Reservation(int mid, int gid, int rn, std::string ci, std::string co, int n, double amt, std::string mp)
-        : id(mid), guestId(gid), roomNumber(rn), checkIn(ci), checkOut(co), nights(n), totalAmount(amt), mealPref(mp) {}
+    Reservation(int mid, int gid, int rn, std::string ci, std::string co, int n, double amt, std::string mp, int ciKey, int coKey)
+        : id(mid), guestId(gid), roomNumber(rn), checkIn(ci), checkOut(co), nights(n), totalAmount(amt), mealPref(mp), checkInKey(ciKey), checkOutKey(coKey) {}
 };
 
 class HotelSystem {
@@ -161,9 +170,12 @@ public:
         
         auto rIt = std::find_if(rooms.begin(), rooms.end(), [&](const std::unique_ptr<Room>& r){ return r->number == rNum; });
         if(rIt == rooms.end()) return {false, "Room not found"};
-        if(!(*rIt)->available) return {false, "Room occupied"};
 
-        if(!isValidDate(in) || !isValidDate(out)) return {false, "Invalid Date (DD/MM/YYYY)"};
+        int from = dateKey(in), to = dateKey(out);
+        if(from < 0 || to < 0) return {false, "Invalid Date (DD/MM/YYYY)"};
+        if(to <= from) return {false, "Check Out must be after Check In"};
+        if(nights != nightsBetween(from, to)) return {false, "Nights must match the dates"};
+        if(!isRoomFree(rNum, from, to)) return {false, "Room occupied"};
 
         std::string meals;
         if(b) meals += "Bfst ";
@@ -172,8 +184,7 @@ public:
         if (nights == 1 && b) meals = "Bfst (Only)";
 
         double total = (*rIt)->price * nights;
-        reservations.emplace_back(nextResId++, gId, rNum, in, out, nights, total, meals);
-        (*rIt)->available = false;
+        reservations.emplace_back(nextResId++, gId, rNum, in, out, nights, total, meals, from, to);
         
         std::stringstream ss;
         ss << "Reserved! ID: " << (nextResId-1) << " Cost: $" << std::fixed << std::setprecision(2) << total;
@@ -184,10 +195,6 @@ public:
         auto it = std::find_if(reservations.begin(), reservations.end(), [&](const Reservation& r){ return r.id == rKey; });
         if(it == reservations.end()) return {false, "Reservation not found"};
         
-        int rNum = it->roomNumber;
-        auto roomIt = std::find_if(rooms.begin(), rooms.end(), [&](const std::unique_ptr<Room>& r){ return r->number == rNum; });
-        if(roomIt != rooms.end()) (*roomIt)->available = true;
-        
         reservations.erase(it);
         return {true, "Checked Out Successfully"};
     }
@@ -198,23 +205,326 @@ public:
         guests.erase(it);
         return {true, "Guest Deleted"};
     }
+
+    // True when no reservation on the room overlaps the stay [from, to), given as dateKey values.
+    bool isRoomFree(int rNum, int from, int to) const {
+        if(from < 0 || to <= from) return false;
+        return std::none_of(reservations.begin(), reservations.end(), [&](const Reservation& r){
+            return r.roomNumber == rNum && r.checkInKey < to && from < r.checkOutKey;
+        });
+    }
+
+    // True when a reservation on the room covers the night of the given dateKey.
+    bool isOccupiedOn(int rNum, int day) const {
+        return std::any_of(reservations.begin(), reservations.end(), [&](const Reservation& r){
+            return r.roomNumber == rNum && r.checkInKey <= day && day < r.checkOutKey;
+        });
+    }
+
+    // Nightly room revenue for every reservation whose stay covers the given dateKey.
+    double revenueOn(int day) const {
+        if(day < 0) return 0.0;
+        double total = 0.0;
+        for(const auto& r : reservations) {
+            if(r.checkInKey > day || day >= r.checkOutKey) continue;
+            auto rIt = std::find_if(rooms.begin(), rooms.end(), [&](const std::unique_ptr<Room>& rm){ return rm->number == r.roomNumber; });
+            if(rIt != rooms.end()) total += (*rIt)->price;
+        }
+        return total;
+    }
+
+    // Orders DD/MM/YYYY dates as YYYYMMDD; -1 for anything that is not a valid date.
+    // Years are capped at 9999 so the key always fits in an int.
+    static int dateKey(const std::string& d) {
+        int day, m, y; char s1, s2;
+        std::stringstream ss(d);
+        if(!(ss >> day >> s1 >> m >> s2 >> y) || s1!='/' || s2!='/') return -1;
+        if(y < 2026 || y > 9999 || m<1 || m>12) return -1;
+        int dim[] = {0,31,28,31,30,31,30,31,31,30,31,30,31};
+        if(isLeap(y)) dim[2]=29;
+        if(day<1 || day>dim[m]) return -1;
+        return y * 10000 + m * 100 + day;
+    }
+
+    // Today's (UTC) date as a dateKey.
+    static int todayKey() {
+        using namespace std::chrono;
+        year_month_day ymd{floor<days>(system_clock::now())};
+        return static_cast<int>(ymd.year()) * 10000 + static_cast<int>(static_cast<unsigned>(ymd.month())) * 100 + static_cast<int>(static_cast<unsigned>(ymd.day()));
+    }
     
 private:
     bool isDigitsOnly(const std::string& s) { return !s.empty() && std::all_of(s.begin(), s.end(), ::isdigit); }
     bool isValidEmail(const std::string& e) { return e.find('@') != std::string::npos && e.find('.') > e.find('@')+1; }
     
-    bool isLeap(int y) { return (y%4==0 && (y%100!=0 || y%400==0)); }
-    bool isValidDate(const std::string& d) {
-        int day, m, y; char s1, s2;
-        std::stringstream ss(d);
-        if(!(ss >> day >> s1 >> m >> s2 >> y) || s1!='/' || s2!='/') return false;
-        if(y < 2026 || m<1 || m>12) return false;
-        int dim[] = {0,31,28,31,30,31,30,31,31,30,31,30,31};
-        if(isLeap(y)) dim[2]=29;
-        return day>=1 && day<=dim[m];
+    static bool isLeap(int y) { return (y%4==0 && (y%100!=0 || y%400==0)); }
+
+    static int nightsBetween(int fromKey, int toKey) {
+        auto toDays = [](int k) {
+            using namespace std::chrono;
+            return sys_days{year{k / 10000} / month{static_cast<unsigned>(k / 100 % 100)} / day{static_cast<unsigned>(k % 100)}};
+        };
+        return static_cast<int>((toDays(toKey) - toDays(fromKey)).count());
+    }
+};
+
+
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(std::size_t workerCount) {
+        if (workerCount == 0) workerCount = 1;
+        for (std::size_t i = 0; i < workerCount; ++i) workers.push_back(std::make_unique<Worker>());
+        for (std::size_t i = 0; i < workerCount; ++i) threads.emplace_back([this, i]() { run(i); });
+    }
+
+    ~WorkStealingPool() {
+        stopping = true;
+        for (auto& w : workers) {
+            std::lock_guard<std::mutex> lk(w->lock);
+            w->wake.notify_all();
+        }
+        for (auto& t : threads) t.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    std::size_t size() const { return workers.size(); }
+
+    // True on any pool worker thread, where blocking on other pool work can deadlock.
+    static bool onWorkerThread() { return onWorker; }
+
+    // Runs only on the given worker; never stolen. Only that worker is woken.
+    void submitPinned(std::size_t worker, std::function<void()> task) {
+        Worker& w = *workers[worker % workers.size()];
+        std::lock_guard<std::mutex> lk(w.lock);
+        w.pinned.push_back(std::move(task));
+        w.wake.notify_one();
+    }
+
+    // Queued on the given worker, but idle workers may steal it.
+    void submitStealable(std::size_t worker, std::function<void()> task) {
+        std::size_t owner = worker % workers.size();
+        Worker& w = *workers[owner];
+        {
+            std::lock_guard<std::mutex> lk(w.lock);
+            w.shared.push_back(std::move(task));
+            ++sharedCount;
+            w.wake.notify_one();
+        }
+        // Also wake one idle peer so it can steal. A peer that isn't asleep yet sees sharedCount
+        // before it waits, because both sides write then read the other's atomic.
+        for (std::size_t i = 1; i < workers.size(); ++i) {
+            Worker& peer = *workers[(owner + i) % workers.size()];
+            if (!peer.sleeping) continue;
+            std::lock_guard<std::mutex> lk(peer.lock);
+            peer.wake.notify_one();
+            break;
+        }
+    }
+
+private:
+    struct Worker {
+        std::mutex lock;
+        std::condition_variable wake;
+        std::deque<std::function<void()>> pinned;
+        std::deque<std::function<void()>> shared;
+        std::atomic<bool> sleeping{false};
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    std::atomic<std::size_t> sharedCount{0};
+    std::atomic<bool> stopping{false};
+    inline static thread_local bool onWorker = false;
+
+    // Owner takes pinned work first, then its own shared queue LIFO for cache warmth.
+    bool popOwn(Worker& w, std::function<void()>& task) {
+        std::lock_guard<std::mutex> lk(w.lock);
+        if (!w.pinned.empty()) { task = std::move(w.pinned.front()); w.pinned.pop_front(); return true; }
+        if (!w.shared.empty()) { task = std::move(w.shared.back()); w.shared.pop_back(); --sharedCount; return true; }
+        return false;
+    }
+
+    // Thieves take the oldest shared task from the next non-empty worker.
+    bool steal(std::size_t self, std::function<void()>& task) {
+        for (std::size_t i = 1; i < workers.size(); ++i) {
+            Worker& victim = *workers[(self + i) % workers.size()];
+            std::lock_guard<std::mutex> lk(victim.lock);
+            if (!victim.shared.empty()) { task = std::move(victim.shared.front()); victim.shared.pop_front(); --sharedCount; return true; }
+        }
+        return false;
+    }
+
+    void run(std::size_t self) {
+        onWorker = true;
+        Worker& w = *workers[self];
+        std::function<void()> task;
+        while (true) {
+            if (popOwn(w, task) || steal(self, task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> lk(w.lock);
+            w.sleeping = true;
+            w.wake.wait(lk, [&]() { return stopping || !w.pinned.empty() || sharedCount > 0; });
+            w.sleeping = false;
+            if (stopping && w.pinned.empty() && sharedCount == 0) return;
+        }
     }
 };
 
+class HotelChain {
+public:
+    struct Property {
+        int id;
+        std::string name, region;
+        HotelSystem hotel;
+        std::mutex lock;
+        Property(int i, std::string n, std::string r) : id(i), name(n), region(r) {}
+    };
+
+    struct RoomMatch {
+        int propertyId, roomNumber;
+        double price;
+    };
+
+    static constexpr std::size_t FAN_OUT_CHUNK = 16;
+
+    explicit HotelChain(std::size_t workerCount = std::max(1u, std::thread::hardware_concurrency()))
+        : pool(workerCount) {}
+
+    int addProperty(const std::string& name, const std::string& region) {
+        std::unique_lock<std::shared_mutex> lk(directoryLock);
+        int id = static_cast<int>(properties.size()) + 1;
+        properties.push_back(std::make_unique<Property>(id, name, region));
+        return id;
+    }
+
+    std::size_t propertyCount() const {
+        std::shared_lock<std::shared_mutex> lk(directoryLock);
+        return properties.size();
+    }
+
+    std::size_t workerCount() const { return pool.size(); }
+
+    // Runs fn(HotelSystem&) on the property's owning shard. Only that property is locked.
+    // fn runs on a pool worker, so it must not call back into the chain: waiting on other
+    // chain work from there can deadlock (always with one worker). Calls made from a pool
+    // worker throw std::logic_error instead of hanging.
+    template <typename F>
+    auto withProperty(int propertyId, F fn) -> std::future<std::invoke_result_t<F&, HotelSystem&>> {
+        using Result = std::invoke_result_t<F&, HotelSystem&>;
+        requireCaller();
+        Property* p = find(propertyId);
+        if (!p) throw std::runtime_error("Property not found");
+
+        auto task = std::make_shared<std::packaged_task<Result()>>([p, fn = std::move(fn)]() mutable {
+            std::lock_guard<std::mutex> lk(p->lock);
+            return fn(p->hotel);
+        });
+        auto result = task->get_future();
+        pool.submitPinned(shardOf(propertyId), [task]() { (*task)(); });
+        return result;
+    }
+
+    // Every room of the given type free for [in, out); an empty region searches the whole chain.
+    // Blocks until every shard has answered; throws std::logic_error if called from a pool worker
+    // and std::invalid_argument for the same bad dates makeReservation rejects.
+    std::vector<RoomMatch> findFreeRooms(const std::string& region, const std::string& type, const std::string& in, const std::string& out) {
+        int from = HotelSystem::dateKey(in), to = HotelSystem::dateKey(out);
+        if (from < 0 || to < 0) throw std::invalid_argument("Invalid Date (DD/MM/YYYY)");
+        if (to <= from) throw std::invalid_argument("Check Out must be after Check In");
+
+        auto partials = fanOut<std::vector<RoomMatch>>([&](Property& p, std::vector<RoomMatch>& found) {
+            if (!region.empty() && p.region != region) return;
+            for (const auto& r : p.hotel.rooms) {
+                if (r->type == type && p.hotel.isRoomFree(r->number, from, to)) found.push_back({p.id, r->number, r->price});
+            }
+        });
+
+        std::vector<RoomMatch> matches;
+        for (auto& part : partials) matches.insert(matches.end(), part.begin(), part.end());
+        std::sort(matches.begin(), matches.end(), [](const RoomMatch& a, const RoomMatch& b) {
+            return a.propertyId != b.propertyId ? a.propertyId < b.propertyId : a.roomNumber < b.roomNumber;
+        });
+        return matches;
+    }
+
+    // Nightly revenue across the chain for the given date; same error rules as findFreeRooms.
+    double groupRevenue(const std::string& date) {
+        int day = HotelSystem::dateKey(date);
+        if (day < 0) throw std::invalid_argument("Invalid Date (DD/MM/YYYY)");
+
+        auto partials = fanOut<double>([&](Property& p, double& total) { total += p.hotel.revenueOn(day); });
+        double total = 0.0;
+        for (double part : partials) total += part;
+        return total;
+    }
+
+private:
+    std::vector<std::unique_ptr<Property>> properties;
+    mutable std::shared_mutex directoryLock;
+    WorkStealingPool pool;
+
+    std::size_t shardOf(int propertyId) const { return static_cast<std::size_t>(propertyId - 1) % pool.size(); }
+
+    Property* find(int propertyId) {
+        std::shared_lock<std::shared_mutex> lk(directoryLock);
+        if (propertyId < 1 || propertyId > static_cast<int>(properties.size())) return nullptr;
+        return properties[propertyId - 1].get();
+    }
+
+    static void requireCaller() {
+        if (WorkStealingPool::onWorkerThread()) throw std::logic_error("HotelChain called from a pool task");
+    }
+
+    // Splits each shard's properties into chunks queued on that shard; idle shards steal chunks.
+    template <typename T, typename Scan>
+    std::vector<T> fanOut(Scan scan) {
+        requireCaller();
+        std::vector<std::vector<Property*>> byShard(pool.size());
+        {
+            std::shared_lock<std::shared_mutex> lk(directoryLock);
+            for (const auto& p : properties) byShard[shardOf(p->id)].push_back(p.get());
+        }
+
+        // Queued chunks reference scan, byShard and the caller's captures, so every one of them
+        // must finish before this frame unwinds, including when a chunk or a submit throws.
+        std::size_t chunkCount = 0;
+        for (const auto& owned : byShard) chunkCount += (owned.size() + FAN_OUT_CHUNK - 1) / FAN_OUT_CHUNK;
+        std::vector<std::future<T>> futures;
+        futures.reserve(chunkCount);
+        struct WaitAll {
+            std::vector<std::future<T>>& futures;
+            ~WaitAll() { for (auto& f : futures) if (f.valid()) f.wait(); }
+        } waitAll{futures};
+
+        for (std::size_t shard = 0; shard < byShard.size(); ++shard) {
+            const auto& owned = byShard[shard];
+            for (std::size_t begin = 0; begin < owned.size(); begin += FAN_OUT_CHUNK) {
+                std::size_t end = std::min(begin + FAN_OUT_CHUNK, owned.size());
+                auto task = std::make_shared<std::packaged_task<T()>>([&scan, &owned, begin, end]() {
+                    T partial{};
+                    for (std::size_t i = begin; i < end; ++i) {
+                        std::lock_guard<std::mutex> lk(owned[i]->lock);
+                        scan(*owned[i], partial);
+                    }
+                    return partial;
+                });
+                futures.push_back(task->get_future());
+                pool.submitStealable(shard, [task]() { (*task)(); });
+            }
+        }
+
+        for (auto& f : futures) f.wait();
+        std::vector<T> partials;
+        partials.reserve(futures.size());
+        for (auto& f : futures) partials.push_back(f.get());
+        return partials;
+    }
+};
 
 
 class NeonButton {
@@ -379,7 +689,85 @@ public:
 enum class AppState { HOME, ADD_GUEST, VIEW_ROOMS, RESERVATION, GUESTS_LIST, RES_LIST, STATS };
 
 
-int main() {
+// Console-only scaling run for HotelChain: `ConsoleApplication1.exe --bench-chain`.
+int runChainBenchmark() {
+    const std::vector<std::string> regions = {"North", "South", "East", "West"};
+    const int reps = 20;
+
+    auto seed = [&](HotelChain& chain, int count) {
+        std::vector<std::future<void>> pending;
+        for (int i = 0; i < count; ++i) {
+            int id = chain.addProperty("Property " + std::to_string(i + 1), regions[i % regions.size()]);
+            pending.push_back(chain.withProperty(id, [i](HotelSystem& h) {
+                for (int g = 0; g < 8; ++g) h.addGuest("Guest " + std::to_string(g), "5550100", "guest@neon.io");
+                h.makeReservation(1001, 301 + i % 5, "10/03/2026", "14/03/2026", 4, true, false, false);
+                h.makeReservation(1002, 201, "12/03/2026", "13/03/2026", 1, false, false, true);
+                h.makeReservation(1003, 101 + i % 10, "01/03/2026", "20/03/2026", 19, false, false, false);
+            }));
+        }
+        for (auto& f : pending) f.get();
+    };
+
+    auto timeQueries = [&](HotelChain& chain, std::size_t& suites, double& revenue) {
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; ++r) {
+            suites = chain.findFreeRooms("North", "Suite", "11/03/2026", "13/03/2026").size();
+            revenue = chain.groupRevenue("12/03/2026");
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / reps;
+    };
+
+    std::cout << std::left << std::setw(12) << "Properties" << std::setw(10) << "Workers"
+              << std::setw(14) << "Serial ms" << std::setw(14) << "Parallel ms" << std::setw(10) << "Speedup"
+              << std::setw(10) << "Suites" << "Revenue" << std::endl;
+
+    for (int count : {1, 10, 100, 250, 500, 1000}) {
+        HotelChain serial(1);
+        HotelChain parallel;
+        seed(serial, count);
+        seed(parallel, count);
+
+        std::size_t suites = 0, serialSuites = 0;
+        double revenue = 0.0, serialRevenue = 0.0;
+        double serialMs = timeQueries(serial, serialSuites, serialRevenue);
+        double parallelMs = timeQueries(parallel, suites, revenue);
+        if (suites != serialSuites || std::abs(revenue - serialRevenue) > 0.01) {
+            std::cerr << "Mismatch between serial and parallel results at " << count << " properties" << std::endl;
+            return 1;
+        }
+
+        // Suite 301 of property 1 is booked 10-14/03, so it must be offered and bookable for a later stay.
+        auto later = parallel.findFreeRooms("", "Suite", "20/03/2026", "22/03/2026");
+        if (later.empty()) {
+            std::cerr << "No free suites reported at " << count << " properties" << std::endl;
+            return 1;
+        }
+        const auto& pick = later.front();
+        auto booked = parallel.withProperty(pick.propertyId, [&pick](HotelSystem& h) {
+            return h.makeReservation(1004, pick.roomNumber, "20/03/2026", "22/03/2026", 2, false, false, false);
+        }).get();
+        auto after = parallel.findFreeRooms("", "Suite", "20/03/2026", "22/03/2026");
+        if (!booked.first || after.size() + 1 != later.size()) {
+            std::cerr << "Room " << pick.roomNumber << " at property " << pick.propertyId
+                      << " was reported free but could not be booked: " << booked.second << std::endl;
+            return 1;
+        }
+
+        std::cout << std::left << std::setw(12) << count << std::setw(10) << parallel.workerCount()
+                  << std::fixed << std::setprecision(3)
+                  << std::setw(14) << serialMs << std::setw(14) << parallelMs
+                  << std::setprecision(2) << std::setw(10) << (parallelMs > 0 ? serialMs / parallelMs : 0.0)
+                  << std::setw(10) << suites << "$" << revenue << std::endl;
+    }
+    return 0;
+}
+
+
+int main(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--bench-chain") return runChainBenchmark();
+    }
+
     sf::RenderWindow window(sf::VideoMode({Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT}), Config::WINDOW_TITLE);
     window.setFramerateLimit(60);
 
@@ -580,15 +968,17 @@ int main() {
             hdr.setPosition({contentX, contentY});
             window.draw(hdr);
             
+            int today = HotelSystem::todayKey();
             float y = contentY + 40.f;
             for(const auto& r : hotel.rooms) {
                 if(y > Config::WINDOW_HEIGHT - 50) break;
+                bool occupied = hotel.isOccupiedOn(r->number, today);
                 std::stringstream ss;
                 ss << "Room " << r->number << " [" << r->type << "] - $" << r->price;
-                if(!r->available) ss << " [OCCUPIED]";
+                if(occupied) ss << " [OCCUPIED]";
                 sf::Text line(font, ss.str(), 14);
                 line.setPosition({contentX, y});
-                line.setFillColor(r->available ? Config::NEON_GREEN : Config::NEON_RED);
+                line.setFillColor(occupied ? Config::NEON_RED : Config::NEON_GREEN);
                 window.draw(line);
                 y += 20.f;
             }
@@ -648,8 +1038,9 @@ int main() {
             hdr.setPosition({contentX, contentY});
             window.draw(hdr);
             
+            int today = HotelSystem::todayKey();
             int occup = 0;
-            for(auto& r : hotel.rooms) if(!r->available) occup++;
+            for(auto& r : hotel.rooms) if(hotel.isOccupiedOn(r->number, today)) occup++;
             
             std::stringstream ss;
             ss << "Total Rooms: " << hotel.rooms.size() << "\n\n";